@@ -4,10 +4,15 @@
 #include <tuple>
 #include <variant>
 
+#include <array>
+#include <bit>
 #include <charconv>
+#include <cstdint>
 #include <filesystem>
 #include <functional>
 #include <optional>
+#include <stdexcept>
+#include <string_view>
 
 namespace g6::router {
 
@@ -228,6 +233,141 @@ namespace g6::router {
     template <class Ret, class... Args>
     struct function_traits<Ret (*)(Args...)> : impl::function_type<Ret, std::nullptr_t, true, false, Args...> {};
 
+    /** @brief Check that a route is made of plain characters only (ie.: it only matches itself)
+     */
+    template <size_t N>
+    constexpr bool is_literal_route(const ctll::fixed_string<N> &route) noexcept {
+      for (size_t ii = 0; ii < route.size(); ++ii) {
+        switch (route[ii]) {
+          case U'\\':
+          case U'^':
+          case U'$':
+          case U'.':
+          case U'|':
+          case U'?':
+          case U'*':
+          case U'+':
+          case U'(':
+          case U')':
+          case U'[':
+          case U']':
+          case U'{':
+          case U'}':
+            return false;
+          default:
+            if (route[ii] > 0x7f) { return false; }
+        }
+      }
+      return true;
+    }
+
+    namespace impl {
+      constexpr std::uint64_t literal_hash(std::string_view input) noexcept {
+        std::uint64_t hash = 0xcbf29ce484222325ull;// FNV-1a
+        for (char c : input) {
+          hash ^= std::uint8_t(c);
+          hash *= 0x100000001b3ull;
+        }
+        return hash;
+      }
+
+      constexpr std::uint64_t literal_mix(std::uint64_t hash, std::uint64_t seed) noexcept {
+        hash ^= seed * 0x9e3779b97f4a7c15ull;// splitmix64 finalizer
+        hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9ull;
+        hash = (hash ^ (hash >> 27)) * 0x94d049bb133111ebull;
+        return hash ^ (hash >> 31);
+      }
+    }// namespace impl
+
+    /** @brief Compile-time perfect hash table of literal routes
+     *
+     * Built with the hash-and-displace method: keys are dispatched into buckets by their hash, then each bucket
+     * gets the first seed placing all of its keys into free slots.
+     * A lookup costs one hash of the path and one string comparison.
+     */
+    template <size_t count>
+    class literal_table {
+      static constexpr size_t slot_count   = std::bit_ceil(2 * count);
+      static constexpr size_t bucket_count = count;
+      static constexpr size_t max_seed     = 1 << 16;
+
+      std::array<std::uint64_t, bucket_count>  seeds_{};
+      std::array<std::string_view, slot_count> keys_{};
+      std::array<size_t, slot_count>           indices_{};
+
+    public:
+      static constexpr size_t npos = size_t(-1);
+
+      constexpr literal_table(const std::array<std::string_view, count> &keys,
+                              const std::array<size_t, count>           &indices) {
+        indices_.fill(npos);
+
+        std::array<std::uint64_t, count> hashes{};
+        std::array<size_t, bucket_count> bucket_sizes{};
+        for (size_t ii = 0; ii < count; ++ii) {
+          hashes[ii] = impl::literal_hash(keys[ii]);
+          ++bucket_sizes[hashes[ii] % bucket_count];
+        }
+
+        // place biggest buckets first
+        std::array<size_t, bucket_count> order{};
+        for (size_t ii = 0; ii < bucket_count; ++ii) {
+          size_t jj = ii;
+          for (; jj > 0 && bucket_sizes[order[jj - 1]] < bucket_sizes[ii]; --jj) { order[jj] = order[jj - 1]; }
+          order[jj] = ii;
+        }
+
+        for (size_t bucket : order) {
+          if (bucket_sizes[bucket] == 0) { break; }
+          for (std::uint64_t seed = 0;; ++seed) {
+            if (seed == max_seed) { throw std::logic_error("g6::router: cannot build literal routes table"); }
+            bool placed = true;
+            for (size_t ii = 0; ii < count && placed; ++ii) {
+              if (hashes[ii] % bucket_count != bucket) { continue; }
+              auto slot = impl::literal_mix(hashes[ii], seed) & (slot_count - 1);
+              if (indices_[slot] != npos) {
+                placed = false;
+              } else {
+                keys_[slot]    = keys[ii];
+                indices_[slot] = indices[ii];
+              }
+            }
+            if (placed) {
+              seeds_[bucket] = seed;
+              break;
+            }
+            // rollback this bucket
+            for (size_t ii = 0; ii < count; ++ii) {
+              if (hashes[ii] % bucket_count != bucket) { continue; }
+              auto slot = impl::literal_mix(hashes[ii], seed) & (slot_count - 1);
+              if (indices_[slot] == indices[ii]) {
+                keys_[slot]    = {};
+                indices_[slot] = npos;
+              }
+            }
+          }
+        }
+      }
+
+      /** @brief Find the handler index of @a path
+       *
+       * @return The index of the handler, or npos
+       */
+      constexpr size_t find(std::string_view path) const noexcept {
+        auto hash = impl::literal_hash(path);
+        auto slot = impl::literal_mix(hash, seeds_[hash % bucket_count]) & (slot_count - 1);
+        return indices_[slot] != npos && keys_[slot] == path ? indices_[slot] : npos;
+      }
+    };
+
+    template <>
+    class literal_table<0> {
+    public:
+      static constexpr size_t npos = size_t(-1);
+
+      constexpr size_t find(std::string_view) const noexcept { return npos; }
+    };
+
   }// namespace detail
 
   template <typename T>
@@ -317,7 +457,19 @@ namespace g6::router {
       static constexpr auto route = route_;
       using fn_type               = FnT;
 
+      static constexpr bool is_literal = detail::is_literal_route(route_);
+
     private:
+      static constexpr auto literal_chars_ = [] {
+        std::array<char, is_literal ? route_.size() : 0> chars{};
+        for (size_t ii = 0; ii < chars.size(); ++ii) { chars[ii] = char(route_[ii]); }
+        return chars;
+      }();
+
+    public:
+      static constexpr std::string_view literal = {literal_chars_.data(), literal_chars_.size()};
+
+    protected:
       using fn_trait = function_traits<fn_type>;
 
       using parameters_tuple_type = detail::tuple_remove_const_refs_t<typename fn_trait::args_tuple>;
@@ -330,7 +482,7 @@ namespace g6::router {
       std::invoke_result_t<decltype(match_), std::string_view> match_result_;
 
       template <int type_idx, int match_idx, typename MatcherT, typename ContextT, typename ArgsT>
-      void _load_data(ContextT &context, parameters_tuple_type &data, const MatcherT &match, ArgsT &&args) {
+      void _load_data(ContextT &context, parameters_tuple_type &data, const MatcherT &match, ArgsT &&args) const {
         if constexpr (type_idx < fn_trait::arity) {
           using ParamT = typename fn_trait::template arg<type_idx>::clean_type;
           if constexpr (detail::specialization_of<ParamT, g6::router::context>) {
@@ -354,24 +506,53 @@ namespace g6::router {
       }
 
       template <typename MatcherT, typename ContextT, typename ArgsT>
-      bool load_data(ContextT &context, const MatcherT &match, parameters_tuple_type &data, ArgsT &&args) {
+      bool load_data(ContextT &context, const MatcherT &match, parameters_tuple_type &data, ArgsT &&args) const {
         _load_data<0, 1>(context, data, match, std::forward<ArgsT>(args));
         return true;
       }
 
+      /** @brief Match @a path and load its parameters, leaving the handler state untouched
+       */
+      template <typename ContextT, typename ArgsT>
+      bool load(ContextT &context, std::string_view path, parameters_tuple_type &data, ArgsT &&args) const {
+        if constexpr (is_literal) {
+          if (path != literal) { return false; }
+          return load_data(context, match_result_, data, std::forward<ArgsT>(args));
+        } else {
+          auto match = handler::match_(path);
+          if (not match) { return false; }
+          return load_data(context, match, data, std::forward<ArgsT>(args));
+        }
+      }
+
     public:
+      static constexpr bool route_matches(std::string_view url) {
+        if constexpr (is_literal) {
+          return url == literal;
+        } else {
+          return bool(handler::match_(url));
+        }
+      }
+
+      /** @brief Match @a url, keeping the match result in the handler (not thread-safe)
+       */
       constexpr bool matches(std::string_view url) {
-        match_result_ = std::move(handler::match_(url));
-        return bool(match_result_);
+        if constexpr (is_literal) {
+          // no capture to load
+          return url == literal;
+        } else {
+          match_result_ = std::move(handler::match_(url));
+          return bool(match_result_);
+        }
       }
 
       using result_t = typename fn_trait::return_type;
 
       template <typename ContextT, typename ArgsT>
       std::optional<result_t> operator()(ContextT &context, std::string_view path, ArgsT &&args) {
-        if (matches(path)) {
-          parameters_tuple_type data{};
-          load_data(context, match_result_, data, std::forward<ArgsT>(args));
+        // stateless matching: handlers can be invoked concurrently
+        parameters_tuple_type data{};
+        if (load(context, path, data, std::forward<ArgsT>(args))) {
           return std::apply(fn_, data);
         } else {
           return {};
@@ -385,6 +566,50 @@ namespace g6::router {
       };
     };
 
+    namespace impl {
+      template <typename HandlersTupleT, size_t index>
+      constexpr bool is_reachable_literal() noexcept {
+        using HandlerT = std::tuple_element_t<index, HandlersTupleT>;
+        if constexpr (not HandlerT::is_literal) {
+          return false;
+        } else {
+          // a previous route matching this one takes precedence
+          return []<size_t... previous>(std::index_sequence<previous...>) {
+            return not(std::tuple_element_t<previous, HandlersTupleT>::route_matches(HandlerT::literal) || ...);
+          }(std::make_index_sequence<index>{});
+        }
+      }
+    }// namespace impl
+
+    /** @brief Build the literal routes table of the given handlers
+     *
+     * Literal routes shadowed by a previous route are left to the regular sequential matching.
+     */
+    template <typename... HandlersT>
+    constexpr auto make_literal_table() {
+      using handlers_t = std::tuple<HandlersT...>;
+      return []<size_t... indices>(std::index_sequence<indices...>) {
+        constexpr size_t count = (size_t(impl::is_reachable_literal<handlers_t, indices>()) + ... + 0);
+        if constexpr (count == 0) {
+          return literal_table<0>{};
+        } else {
+          std::array<std::string_view, count> keys{};
+          std::array<size_t, count>           handler_indices{};
+          size_t                              position = 0;
+          (
+            [&] {
+              if constexpr (impl::is_reachable_literal<handlers_t, indices>()) {
+                keys[position]            = std::tuple_element_t<indices, handlers_t>::literal;
+                handler_indices[position] = indices;
+                ++position;
+              }
+            }(),
+            ...);
+          return literal_table<count>{keys, handler_indices};
+        }
+      }(std::index_sequence_for<HandlersT...>{});
+    }
+
   }// namespace detail
 
   template <ctll::fixed_string route, typename FnT>
@@ -413,20 +638,59 @@ namespace g6::router {
       // all handlers returns same type = dont use variant
       std::tuple_element_t<0, handlers_return_tuple>, detail::tuple_to_variant_t<handlers_return_tuple>>;
 
+  private:
+    static constexpr auto literal_table_ = detail::make_literal_table<HandlersT...>();
+
+    template <size_t index, typename ArgsT>
+    static std::optional<result_t> invoke_handler(router &self, std::string_view path, ArgsT &&args) {
+      if (auto result = std::get<index>(self.handlers_)(self.context_, path, std::forward<ArgsT>(args)); result) {
+        return std::move(result.value());
+      }
+      return {};
+    }
+
+    template <typename ArgsT, size_t... indices>
+    static constexpr auto make_dispatch_table(std::index_sequence<indices...>) noexcept {
+      return std::array{&router::invoke_handler<indices, ArgsT>...};
+    }
+
+    template <typename ArgsT>
+    static constexpr auto dispatch_table_ = make_dispatch_table<ArgsT>(std::index_sequence_for<HandlersT...>{});
+
+  public:
     template <typename... HandlerArgsT>
     constexpr auto operator()(std::string_view path, HandlerArgsT &&...args) {
       std::optional<result_t> output;
-      detail::for_each(handlers_, [&](auto &&handler) {
-        if (auto result = handler(context_, path, std::make_tuple(std::forward<HandlerArgsT>(args)...)); result) {
-          output = std::move(result.value());
-          return detail::break_;
-        }
-        return detail::continue_;
-      });
+      size_t                  first = 0;
+      // literal routes fast path
+      if (auto literal_index = literal_table_.find(path); literal_index != literal_table_.npos) {
+        using args_t = decltype(std::make_tuple(std::forward<HandlerArgsT>(args)...));
+        output       = dispatch_table_<args_t>[literal_index](*this, path,
+                                                            std::make_tuple(std::forward<HandlerArgsT>(args)...));
+        // previous routes are known not to match
+        first = literal_index + 1;
+      }
+      if (not output) {
+        detail::for_each(handlers_, [&]<size_t index>(auto &&handler) {
+          if (index < first) { return detail::continue_; }
+          if (auto result = handler(context_, path, std::make_tuple(std::forward<HandlerArgsT>(args)...)); result) {
+            output = std::move(result.value());
+            return detail::break_;
+          }
+          return detail::continue_;
+        });
+      }
       assert(output);
       return std::move(output).value();
     }
 
+    /** @brief Access the handler at @a index (ie.: to read a cached route statistics)
+     */
+    template <size_t index>
+    constexpr auto &get() noexcept {
+      return std::get<index>(handlers_);
+    }
+
   protected:
     handlers_t handlers_;
   };
@@ -0,0 +1,231 @@
+#pragma once
+
+#include <g6/router.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <future>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace g6::router {
+
+  struct cache_options {
+    size_t                              capacity = 1024;// maximum number of entries (all shards)
+    size_t                              shards   = 16;// clamped to capacity
+    std::chrono::steady_clock::duration ttl      = std::chrono::minutes{1};
+  };
+
+  struct cache_stats {
+    std::uint64_t hits   = 0;
+    std::uint64_t misses = 0;
+
+    constexpr double hit_rate() const noexcept {
+      return hits + misses == 0 ? 0. : double(hits) / double(hits + misses);
+    }
+  };
+
+  namespace detail {
+    template <typename TupleT>
+    struct tuple_hash;
+
+    template <typename... TypesT>
+    struct tuple_hash<std::tuple<TypesT...>> {
+      size_t operator()(const std::tuple<TypesT...> &tuple) const noexcept {
+        return std::apply(
+          [](const auto &...values) {
+            size_t seed = 0;
+            ((seed ^= std::hash<std::decay_t<decltype(values)>>{}(values) + 0x9e3779b9 + (seed << 6) + (seed >> 2)),
+             ...);
+            return seed;
+          },
+          tuple);
+      }
+    };
+
+    namespace impl {
+      constexpr std::uint64_t shard_mix(std::uint64_t hash) noexcept {
+        hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9ull;// splitmix64 finalizer
+        hash = (hash ^ (hash >> 27)) * 0x94d049bb133111ebull;
+        return hash ^ (hash >> 31);
+      }
+    }// namespace impl
+
+    /** @brief Owning type used to store a loaded parameter in a cache key
+     */
+    template <typename T>
+    struct cache_key_element {
+      using type = T;
+    };
+
+    template <>
+    struct cache_key_element<std::string_view> {
+      using type = std::string;
+    };
+
+    template <typename TupleT>
+    struct cache_key;
+
+    template <typename... TypesT>
+    struct cache_key<std::tuple<TypesT...>> {
+      using type = std::tuple<typename cache_key_element<TypesT>::type...>;
+    };
+
+    template <typename TupleT>
+    using cache_key_t = typename cache_key<TupleT>::type;
+
+    /** @brief Bounded and sharded memoisation store
+     *
+     * Each shard is a mutex protected LRU map, so concurrent calls of a router share the store.
+     * Entries expire once the configured ttl elapsed after their value became available.
+     * Concurrent misses on the same key are single-flighted: the first caller invokes the function while the others
+     * wait for its result. A failed invocation is not cached, its exception is forwarded to all waiting callers.
+     */
+    template <typename KeyT, typename ValueT>
+    class memo_cache {
+      using clock_type = std::chrono::steady_clock;
+
+      struct entry {
+        std::shared_future<ValueT>         value;
+        clock_type::time_point             expiry;
+        typename std::list<KeyT>::iterator lru;
+        std::uint64_t                      generation;
+      };
+
+      struct shard {
+        std::mutex                                        mutex;
+        std::unordered_map<KeyT, entry, tuple_hash<KeyT>> entries;
+        std::list<KeyT>                                   lru;// most recently used first
+        std::uint64_t                                     generation = 0;
+      };
+
+      std::unique_ptr<shard[]>   shards_;
+      size_t                     shard_count_;
+      size_t                     shard_capacity_;
+      clock_type::duration       ttl_;
+      std::atomic<std::uint64_t> hits_   = 0;
+      std::atomic<std::uint64_t> misses_ = 0;
+
+      shard &shard_of(const KeyT &key) noexcept {
+        return shards_[impl::shard_mix(tuple_hash<KeyT>{}(key)) % shard_count_];
+      }
+
+    public:
+      explicit memo_cache(const cache_options &options)
+          : shard_count_{std::clamp<size_t>(options.shards, 1, std::max<size_t>(options.capacity, 1))}
+          , shard_capacity_{std::max<size_t>(options.capacity / shard_count_, 1)}
+          , ttl_{options.ttl} {
+        shards_ = std::make_unique<shard[]>(shard_count_);
+      }
+
+      template <typename FnT>
+      ValueT get_or_invoke(const KeyT &key, FnT &&fn) {
+        auto                               &shard = shard_of(key);
+        std::optional<std::promise<ValueT>> promise;
+        std::shared_future<ValueT>          future;
+        std::uint64_t                       generation = 0;
+        {
+          std::scoped_lock lock{shard.mutex};
+          auto             now = clock_type::now();
+          if (auto it = shard.entries.find(key); it != shard.entries.end()) {
+            if (it->second.expiry > now) {
+              shard.lru.splice(shard.lru.begin(), shard.lru, it->second.lru);
+              future = it->second.value;
+            } else {
+              shard.lru.erase(it->second.lru);
+              shard.entries.erase(it);
+            }
+          }
+          if (future.valid()) {
+            ++hits_;
+          } else {
+            ++misses_;
+            if (shard.entries.size() >= shard_capacity_) {
+              shard.entries.erase(shard.lru.back());
+              shard.lru.pop_back();
+            }
+            future     = promise.emplace().get_future().share();
+            generation = ++shard.generation;
+            shard.lru.push_front(key);
+            // in-flight entries never expire: concurrent misses wait for them
+            shard.entries.emplace(key, entry{future, clock_type::time_point::max(), shard.lru.begin(), generation});
+          }
+        }
+        if (generation != 0) {
+          // this call owns the entry
+          bool failed = false;
+          try {
+            promise->set_value(std::forward<FnT>(fn)());
+          } catch (...) {
+            promise->set_exception(std::current_exception());
+            failed = true;
+          }
+          std::scoped_lock lock{shard.mutex};
+          if (auto it = shard.entries.find(key); it != shard.entries.end() && it->second.generation == generation) {
+            if (failed) {
+              shard.lru.erase(it->second.lru);
+              shard.entries.erase(it);
+            } else {
+              it->second.expiry = clock_type::now() + ttl_;
+            }
+          }
+        }
+        return future.get();
+      }
+
+      cache_stats stats() const noexcept { return {hits_.load(), misses_.load()}; }
+    };
+
+    template <auto route_, typename FnT>
+    class cached_handler : public handler<route_, FnT> {
+      using base = handler<route_, FnT>;
+
+      static_assert(
+        []<size_t... indices>(std::index_sequence<indices...>) {
+          return not(
+            specialization_of<typename base::fn_trait::template arg<indices>::clean_type, g6::router::context> || ...);
+        }(std::make_index_sequence<base::fn_trait::arity>{}),
+        "g6::router::cached: handlers must be pure functions of their captured parameters (no context)");
+
+      using key_type   = cache_key_t<typename base::parameters_tuple_type>;
+      using cache_type = memo_cache<key_type, typename base::result_t>;
+
+      std::unique_ptr<cache_type> cache_;
+
+    public:
+      explicit cached_handler(FnT &&fn, const cache_options &options)
+          : base{std::forward<FnT>(fn)}
+          , cache_{std::make_unique<cache_type>(options)} {}
+
+      using typename base::result_t;
+
+      template <typename ContextT, typename ArgsT>
+      std::optional<result_t> operator()(ContextT &context, std::string_view path, ArgsT &&args) {
+        typename base::parameters_tuple_type data{};
+        if (not base::load(context, path, data, std::forward<ArgsT>(args))) { return {}; }
+        // keys outlive the request: views into it are copied
+        return cache_->get_or_invoke(key_type(data), [this, &data] { return std::apply(base::fn_, data); });
+      }
+
+      /** @brief Hit/miss counters of this route
+       *
+       * Counters are atomic and cover all the threads calling the router.
+       */
+      cache_stats stats() const noexcept { return cache_->stats(); }
+    };
+  }// namespace detail
+
+  /** @brief Declare a route whose results are memoised on its captured parameters
+   *
+   * The handler must be a pure function of its captured parameters, and its result copyable.
+   */
+  template <ctll::fixed_string route, typename FnT>
+  auto cached(FnT &&fn, const cache_options &options = {}) {
+    return detail::cached_handler<route, FnT>{std::forward<FnT>(fn), options};
+  }
+
+}// namespace g6::router
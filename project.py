@@ -21,11 +21,15 @@ basic_test: Executable = project.executable('g6-router-basic-route-test')
 basic_test.sources = 'tests/basic-route-test.cpp'
 basic_test.link_libraries = 'fmt'
 
+cached_test: Executable = project.executable('g6-router-cached-route-test')
+cached_test.sources = 'tests/cached-route-test.cpp'
+cached_test.link_libraries = 'fmt', 'pthread'
+
 beast_example: Executable = project.executable('g6-http-router-example')
 beast_example.sources = 'examples/http_router.cpp'
 beast_example.link_libraries = router, 'boost', 'spdlog', 'fmt'
 
-router.tests = basic_test, beast_example
+router.tests = basic_test, cached_test, beast_example
 
 if __name__ == '__main__':
     main()
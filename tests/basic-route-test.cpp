@@ -51,3 +51,80 @@ SCENARIO("g6::router local context usage", "[g6][router][context]") {
   }
   //  REQUIRE(test_router("/this/does/not/exist", session{.id = 51}) == "not found");
 }
+
+TEST_CASE("g6::router literal routes", "[g6][router][literal]") {
+  STATIC_REQUIRE(decltype(g6::router::on<R"(/healthz)">([]() {}))::is_literal);
+  STATIC_REQUIRE(not decltype(g6::router::on<R"(/echo/(\w+))">([]() {}))::is_literal);
+  STATIC_REQUIRE(not decltype(g6::router::on<R"(/a.b)">([]() {}))::is_literal);
+
+  g6::router::router test_router{
+    g6::router::on<R"(/healthz)">([]() -> std::string { return "healthy"; }),
+    g6::router::on<R"(/echo/(\w+))">([](const std::string &value) -> std::string { return value; }),
+    g6::router::on<R"(/echo/literal)">([]() -> std::string { return "shadowed"; }),
+    g6::router::on<R"(/metrics)">([]() -> std::string { return "metrics"; }),
+    g6::router::on<R"(/api/v1/status)">([]() -> std::string { return "status"; }),
+    g6::router::on<R"(.*)">([]() -> std::string { return "not found"; })};
+  REQUIRE(test_router("/healthz") == "healthy");
+  REQUIRE(test_router("/metrics") == "metrics");
+  REQUIRE(test_router("/api/v1/status") == "status");
+  REQUIRE(test_router("/echo/literal") == "literal");
+  REQUIRE(test_router("/healthz/") == "not found");
+  REQUIRE(test_router("/metric") == "not found");
+  REQUIRE(test_router("") == "not found");
+}
+
+TEST_CASE("g6::router literal routes table", "[g6][router][literal]") {
+  constexpr auto table = g6::router::detail::literal_table<4>{{"/a", "/b", "/healthz", "/metrics"}, {0, 1, 4, 7}};
+  STATIC_REQUIRE(table.find("/a") == 0);
+  STATIC_REQUIRE(table.find("/b") == 1);
+  STATIC_REQUIRE(table.find("/healthz") == 4);
+  STATIC_REQUIRE(table.find("/metrics") == 7);
+  STATIC_REQUIRE(table.find("/c") == table.npos);
+  STATIC_REQUIRE(table.find("") == table.npos);
+}
+
+namespace {
+  template <auto route, typename FnT>
+  struct counting_handler : g6::router::detail::handler<route, FnT> {
+    using base = g6::router::detail::handler<route, FnT>;
+
+    counting_handler(FnT &&fn, int &calls, bool decline) noexcept
+        : base{std::forward<FnT>(fn)}
+        , calls_{&calls}
+        , decline_{decline} {}
+
+    using base::matches;
+
+    template <typename ContextT, typename ArgsT>
+    std::optional<typename base::result_t> operator()(ContextT &context, std::string_view path, ArgsT &&args) {
+      ++*calls_;
+      if (decline_) { return {}; }
+      return base::operator()(context, path, std::forward<ArgsT>(args));
+    }
+
+    int *calls_;
+    bool decline_;
+  };
+
+  template <ctll::fixed_string route, typename FnT>
+  auto counting(FnT &&fn, int &calls, bool decline = false) noexcept {
+    return counting_handler<route, FnT>{std::forward<FnT>(fn), calls, decline};
+  }
+}// namespace
+
+TEST_CASE("g6::router literal routes fallback", "[g6][router][literal]") {
+  int echo_calls    = 0;
+  int healthz_calls = 0;
+
+  g6::router::router test_router{
+    counting<R"(/echo/(\w+))">([](const std::string &value) -> std::string { return value; }, echo_calls),
+    counting<R"(/healthz)">([]() -> std::string { return "healthy"; }, healthz_calls, true),
+    g6::router::on<R"(/healthz)">([]() -> std::string { return "fallback"; }),
+    g6::router::on<R"(.*)">([]() -> std::string { return "not found"; })};
+  REQUIRE(test_router("/healthz") == "fallback");
+  REQUIRE(healthz_calls == 1);
+  REQUIRE(echo_calls == 0);
+  REQUIRE(test_router("/echo/42") == "42");
+  REQUIRE(healthz_calls == 1);
+  REQUIRE(echo_calls == 1);
+}
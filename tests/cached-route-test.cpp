@@ -0,0 +1,160 @@
+#define CATCH_CONFIG_MAIN
+#include <catch2/catch.hpp>
+#include <fmt/format.h>
+
+#include <g6/router/cached.hpp>
+
+#include <thread>
+#include <vector>
+
+TEST_CASE("g6::router cached routes", "[g6][router][cached]") {
+  int                calls = 0;
+  g6::router::router test_router{
+    g6::router::cached<R"(/hello/(\w+))">([&calls](const std::string &who) -> std::string {
+      ++calls;
+      return fmt::format("Hello {} !", who);
+    }),
+    g6::router::cached<R"(/metrics)">([&calls]() -> std::string {
+      ++calls;
+      return "metrics";
+    }),
+    g6::router::on<R"(.*)">([]() -> std::string { return "not found"; })};
+  REQUIRE(test_router("/hello/world") == "Hello world !");
+  REQUIRE(test_router("/hello/world") == "Hello world !");
+  REQUIRE(test_router("/hello/g6") == "Hello g6 !");
+  REQUIRE(test_router("/this/does/not/exist") == "not found");
+  REQUIRE(calls == 2);
+
+  auto stats = test_router.get<0>().stats();
+  REQUIRE(stats.hits == 1);
+  REQUIRE(stats.misses == 2);
+  REQUIRE(stats.hit_rate() == Approx(1. / 3.));
+
+  // literal route: served by the literal routes table, with an empty key
+  STATIC_REQUIRE(std::remove_cvref_t<decltype(test_router.get<1>())>::is_literal);
+  REQUIRE(test_router("/metrics") == "metrics");
+  REQUIRE(test_router("/metrics") == "metrics");
+  REQUIRE(calls == 3);
+  REQUIRE(test_router.get<1>().stats().hits == 1);
+}
+
+TEST_CASE("g6::router cached routes expiration", "[g6][router][cached]") {
+  int  calls   = 0;
+  auto handler = [&calls] {
+    return [&calls](const std::string &value) -> std::string {
+      ++calls;
+      return value;
+    };
+  };
+
+  SECTION("capacity") {
+    g6::router::router test_router{
+      g6::router::cached<R"(/echo/(\w+))">(handler(), {.capacity = 1, .shards = 1, .ttl = std::chrono::minutes{1}})};
+    REQUIRE(test_router("/echo/42") == "42");
+    REQUIRE(test_router("/echo/42") == "42");
+    REQUIRE(calls == 1);
+
+    // capacity exceeded
+    REQUIRE(test_router("/echo/43") == "43");
+    REQUIRE(test_router("/echo/42") == "42");
+    REQUIRE(calls == 3);
+  }
+
+  SECTION("ttl") {
+    g6::router::router test_router{
+      g6::router::cached<R"(/echo/(\w+))">(handler(), {.ttl = std::chrono::milliseconds{10}})};
+    REQUIRE(test_router("/echo/42") == "42");
+    std::this_thread::sleep_for(std::chrono::milliseconds{50});
+    REQUIRE(test_router("/echo/42") == "42");
+    REQUIRE(calls == 2);
+  }
+}
+
+TEST_CASE("g6::router cached routes views", "[g6][router][cached]") {
+  int                calls = 0;
+  g6::router::router test_router{g6::router::cached<R"(/view/(\w+))">([&calls](std::string_view value) -> std::string {
+    ++calls;
+    return std::string{value};
+  })};
+  {
+    std::string path = "/view/aaa";
+    REQUIRE(test_router(path) == "aaa");
+    // reuse the request buffer: a key viewing it would now read "bbb"
+    path.replace(6, 3, "bbb");
+  }
+  REQUIRE(test_router("/view/aaa") == "aaa");
+  REQUIRE(calls == 1);
+}
+
+TEST_CASE("g6::router cached routes failures", "[g6][router][cached]") {
+  int                calls = 0;
+  g6::router::router test_router{g6::router::cached<R"(/fail/(\w+))">([&calls](const std::string &) -> std::string {
+    if (++calls == 1) { throw std::runtime_error("failure"); }
+    return "ok";
+  })};
+  REQUIRE_THROWS_AS(test_router("/fail/42"), std::runtime_error);
+  REQUIRE(test_router("/fail/42") == "ok");
+  REQUIRE(test_router("/fail/42") == "ok");
+  REQUIRE(calls == 2);
+}
+
+TEST_CASE("g6::router cached routes single-flight", "[g6][router][cached]") {
+  std::atomic<int>   calls = 0;
+  g6::router::router test_router{
+    g6::router::cached<R"(/slow/(\w+))">([&calls](const std::string &value) -> std::string {
+      ++calls;
+      std::this_thread::sleep_for(std::chrono::milliseconds{50});
+      return value;
+    }),
+    g6::router::on<R"(.*)">([]() -> std::string { return "not found"; })};
+
+  std::vector<std::string> results(8);
+  std::vector<std::thread> threads;
+  for (auto &result : results) {
+    threads.emplace_back([&] { result = test_router("/slow/42"); });
+  }
+  for (auto &thread : threads) { thread.join(); }
+  REQUIRE(std::all_of(results.begin(), results.end(), [](auto &result) { return result == "42"; }));
+  REQUIRE(calls == 1);
+
+  auto stats = test_router.get<0>().stats();
+  REQUIRE(stats.hits == 7);
+  REQUIRE(stats.misses == 1);
+}
+
+TEST_CASE("g6::router cached routes capacity", "[g6][router][cached]") {
+  using cache_type = g6::router::detail::memo_cache<std::tuple<int>, int>;
+  cache_type cache{{.capacity = 4, .shards = 16}};
+  for (int pass = 0; pass < 2; ++pass) {
+    for (int key = 0; key < 8; ++key) {
+      REQUIRE(cache.get_or_invoke({key}, [key] { return key; }) == key);
+    }
+  }
+  REQUIRE(cache.stats().hits <= 4);
+}
+
+TEST_CASE("g6::router cached routes slow invocations", "[g6][router][cached]") {
+  using cache_type = g6::router::detail::memo_cache<std::tuple<int>, int>;
+  using clock_type = std::chrono::steady_clock;
+  constexpr auto ttl = std::chrono::milliseconds{100};
+
+  cache_type cache{{.ttl = ttl}};
+  auto       start = clock_type::now();
+  REQUIRE(cache.get_or_invoke({42}, [ttl] {
+    std::this_thread::sleep_for(2 * ttl);
+    return 42;
+  }) == 42);
+  auto available = clock_type::now();
+  auto value     = cache.get_or_invoke({42}, [] { return 0; });
+  auto elapsed   = clock_type::now() - available;
+  // the entry is older than the ttl...
+  REQUIRE(clock_type::now() - start > ttl);
+  if (elapsed < ttl) {
+    // ...but still fresh since its value became available
+    REQUIRE(value == 42);
+    REQUIRE(cache.stats().hits == 1);
+  } else {
+    // stalled long enough for the entry to legitimately expire
+    REQUIRE((value == 42) == (cache.stats().hits == 1));
+  }
+}